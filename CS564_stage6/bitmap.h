@@ -0,0 +1,107 @@
+#ifndef BITMAP_H
+#define BITMAP_H
+
+#include "heapfile.h"
+
+// A bitmap compressed with word-aligned hybrid (WAH) coding.  Its bits
+// are taken 31 at a time, and each group is stored in a 32-bit word:
+// a literal word (top bit 0) holds the 31 bits themselves, and a fill
+// word (top bit 1) stands for a run of groups whose bits are all the
+// same, given by bit 30, with the number of groups in the low 30 bits.
+// Bitmaps are combined run by run, without expanding the fills.
+
+class WAHBitmap
+{
+public:
+  WAHBitmap() : groupCnt(0) {}
+
+  // value of bit pos, false beyond the end of the bitmap
+  const bool test(const unsigned int pos) const;
+
+  // set bit pos to bit, growing the bitmap if pos is beyond its end
+  void set(const unsigned int pos, const bool bit);
+
+  // out = a AND b, or a OR b
+  static void combine(const WAHBitmap & a, const WAHBitmap & b,
+		      const bool isAnd, WAHBitmap & out);
+
+  // the positions of the bits that are set, in increasing order
+  void positions(vector<unsigned int> & out) const;
+
+  vector<unsigned int>	words;		// the compressed bits
+  unsigned int		groupCnt;	// number of 31-bit groups in words
+
+private:
+  void appendGroup(const unsigned int bits);
+  void appendFill(const bool bit, unsigned int n);
+};
+
+// A bitmap index on one attribute of a relation: a bitmap for each
+// distinct value of the attribute, with the bit of a tuple set in the
+// bitmap of its value.  The bit of a tuple follows from its RID, so
+// the tuples a bitmap stands for are fetched in the order they are
+// stored.  It is meant for attributes with few distinct values, where
+// the bitmaps compress well; they are all read into memory when the
+// index is opened, and written back when it is closed.
+
+// bits of a page in a bitmap
+const int BITMAPSLOTS = MAXSLOTS + 1;
+
+// a page of an index file.  The file is a chain of these, holding the
+// key type and length, the number of values, and then the key and
+// bitmap of each value
+struct BitmapPage
+{
+  int		nextPage;	// pageNo of the next page, -1 if none
+  int		used;		// bytes of data used
+  char		data[PAGESIZE - 2 * sizeof(int)];
+};
+
+class BitmapIndex
+{
+public:
+
+  // create the (empty) index on attribute attrName of relName
+  static const Status create(const string & relName,
+			     const string & attrName,
+			     const Datatype type, const int keyLen);
+
+  // remove the index on attribute attrName of relName
+  static const Status destroy(const string & relName,
+			      const string & attrName);
+
+  // open the index on attribute attrName of relName
+  BitmapIndex(const string & relName, const string & attrName,
+	      Status & status);
+
+  // write the index back if it changed, and close it
+  ~BitmapIndex();
+
+  // add the entry (key, rid); key points at keyLen bytes
+  const Status insertEntry(const void* key, const RID & rid);
+
+  // remove the entry (key, rid), RECNOTFOUND if there is none
+  const Status deleteEntry(const void* key, const RID & rid);
+
+  // set out to the bitmap of the tuples whose key is op value
+  const Status select(const Operator op, const void* value,
+		      WAHBitmap & out) const;
+
+  // the RID of the tuple of bit pos
+  static void posToRid(const unsigned int pos, RID & rid);
+
+private:
+  File*		file;		// the index file
+  bool		dirty;		// true if the bitmaps changed
+  Datatype	type;		// datatype of the key
+  int		keyLen;		// length of the key
+  vector<char>	keys;		// the distinct values, keyLen bytes each
+  vector<WAHBitmap> maps;	// the bitmap of each value
+
+  const int keyCmp(const char* a, const char* b) const;
+  const int findKey(const char* key) const;
+  const Status read();
+  const Status write();
+};
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef BTREE_H
+#define BTREE_H
+
+#include "heapfile.h"
+
+// A B+-tree index on one attribute of a relation, kept in a file of
+// its own and read through the buffer manager a node per page.
+//
+// The tree orders its entries by (key, RID), so that an attribute
+// may hold the same value in many tuples and still every entry has
+// a place of its own; inner nodes hold (key, RID) separators too.
+// The leaves are chained left to right for range scans.  Deletions
+// only take entries out of their leaves: nodes are never merged, and
+// a leaf emptied by deletions stays in the tree until it is rebuilt.
+//
+// An index is built by loading it bottom-up from its entries in key
+// order: the leaves are filled left to right, each to BTREEFILL of its
+// capacity, and the inner levels are built above them as they go, so
+// that later inserts find room in the nodes.
+
+// fraction of each node filled when an index is loaded
+const float BTREEFILL = 0.9;
+
+// first page of an index file
+struct BTreeHdr
+{
+  int		rootPage;	// pageNo of the root node
+  int		height;		// number of levels, 1 if the root is a leaf
+  int		keyType;	// Datatype of the key
+  int		keyLen;		// length of the key in bytes
+  int		entryCnt;	// number of entries
+};
+
+// one node of the tree.  A leaf holds keyCnt (key, RID) entries; an
+// inner node holds a child pageNo followed by keyCnt (key, RID, child)
+// entries, where each separator is the smallest entry of the subtree
+// of the child that follows it.
+struct BTreeNode
+{
+  int		level;		// 0 for a leaf, 1 + level of children else
+  int		keyCnt;		// number of entries in the node
+  int		nextPage;	// leaves: pageNo of right sibling, -1 if none
+  char		data[PAGESIZE - 3 * sizeof(int)];
+};
+
+class BTreeIndex
+{
+public:
+
+  // create the (empty) index on attribute attrName of relName
+  static const Status create(const string & relName,
+			     const string & attrName,
+			     const Datatype type, const int keyLen);
+
+  // remove the index on attribute attrName of relName
+  static const Status destroy(const string & relName,
+			      const string & attrName);
+
+  // open the index on attribute attrName of relName
+  BTreeIndex(const string & relName, const string & attrName,
+	     Status & status);
+
+  // end any scan and close the index
+  ~BTreeIndex();
+
+  // add the entry (key, rid); key points at keyLen bytes
+  const Status insertEntry(const void* key, const RID & rid);
+
+  // remove the entry (key, rid), RECNOTFOUND if there is none
+  const Status deleteEntry(const void* key, const RID & rid);
+
+  // start a scan of the entries whose keys lie between a lower bound
+  // (lowOp GT or GTE) and an upper bound (highOp LT or LTE), in key
+  // order.  A NULL value leaves that end of the range open
+  const Status startScan(const void* lowVal, const Operator lowOp,
+			 const void* highVal, const Operator highOp);
+
+  // return the RID of the next entry of the scan, NOMORERECS at end
+  const Status scanNext(RID & outRid);
+
+  // the same, also pointing key at the key of the entry, which stays
+  // valid until the next call
+  const Status scanNext(RID & outRid, const char* & key);
+
+  // end the scan
+  const Status endScan();
+
+  // start loading the (empty) index, filling nodes to fill of their
+  // capacity
+  const Status startLoad(const float fill);
+
+  // add the entry (key, rid) to the index being loaded.  The entries
+  // must come in key order; those with the same key may come in any
+  // order of their RIDs
+  const Status loadEntry(const void* key, const RID & rid);
+
+  // write out the last node of each level and finish the load
+  const Status endLoad();
+
+  // number of entries in the index
+  const int getEntryCnt() const { return hdr->entryCnt; }
+
+private:
+  File*		file;		// the index file
+  int		hdrPageNo;	// pageNo of the header page, kept pinned
+  BTreeHdr*	hdr;		// the header page
+  bool		hdrDirty;	// true if the header page was updated
+  Datatype	type;		// datatype of the key
+  int		keyLen;		// length of the key
+  int		leafCap;	// max. entries in a leaf
+  int		innerCap;	// max. entries in an inner node
+
+  // state of the scan
+  int		scanPageNo;	// pinned leaf, -1 if none
+  BTreeNode*	scanNode;
+  int		scanPos;	// next entry of the leaf
+  bool		scanHigh;	// true if there is an upper bound
+  Operator	highOp;
+  vector<char>	highKey;
+
+  // state of a load: the node being filled at each level, leaves first
+  struct LoadNode
+  {
+    int		pageNo;
+    BTreeNode	node;
+  };
+  vector<LoadNode> loadNodes;
+  int		leafTarget;	// entries to put in a leaf
+  int		innerTarget;	// entries to put in an inner node
+  vector<char>	groupKey;	// key of the entries held back in groupRids
+  vector<RID>	groupRids;
+
+  const int keyCmp(const char* a, const char* b) const;
+  const int entryCmp(const char* key, const RID & rid,
+		     const char* entry) const;
+  const int leafSize() const { return keyLen + sizeof(RID); }
+  const int innerSize() const { return keyLen + sizeof(RID) + sizeof(int); }
+  char* leafEntry(BTreeNode* node, const int i) const;
+  char* innerEntry(BTreeNode* node, const int i) const;
+  const int getChild(BTreeNode* node, const int i) const;
+  void setChild(BTreeNode* node, const int i, const int pageNo) const;
+  const int findPos(BTreeNode* node, const char* key,
+		    const RID & rid) const;
+
+  const Status insertAt(const int pageNo, const char* key,
+			const RID & rid, bool & split,
+			char* upEntry, int & upPage);
+  const Status splitLeaf(BTreeNode* node, const int pos,
+			 const char* key, const RID & rid,
+			 char* upEntry, int & upPage);
+  const Status splitInner(BTreeNode* node, const int pos,
+			  const char* entry, const int right,
+			  char* upEntry, int & upPage);
+
+  const Status loadGroup();
+  const Status loadLeafEntry(const char* entry);
+  const Status loadSeparator(const unsigned int level, const char* entry,
+			     const int left, const int right);
+  const Status writeLoadNode(const unsigned int level);
+};
+
+#endif
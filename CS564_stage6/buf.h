@@ -105,6 +105,8 @@ private:
   BufHashTbl*    hashTable;  	// hash table mapping (File, page) to frame
   BufDesc*	 bufTable;  	// vector of status info, 1 per page
   BufStats	 bufStats;	// buffer pool statistics
+  mutex		 bufLock;	// held by every public operation so that
+				// several threads can share the pool
 
   const Status allocBuf(int & frame);   // allocate a free frame.  
   const void releaseBuf(int frame); // return unused frame to end of list
@@ -126,6 +128,7 @@ public:
                         // allocates a new, empty page 
   const Status flushFile(const File* file); // writing out all dirty pages of the file
   const Status disposePage(File* file, const int PageNo); // dispose of page in file
+  const int numUnpinned();  // number of frames no page is pinned in
   void  printSelf();
 
   const BufStats & getBufStats() const // get buffer pool usage
@@ -1,6 +1,8 @@
 #ifndef CATALOG_H
 #define CATALOG_H
 
+#include <stddef.h>
+#include <unordered_map>
 #include "heapfile.h"
 
 
@@ -10,10 +12,15 @@
 
 #define RELCATNAME   "relcat"           // name of relation catalog
 #define ATTRCATNAME  "attrcat"          // name of attribute catalog
+#define STATCATNAME  "statcat"          // name of statistics catalog
 #define MAXNAME      32                 // length of relName, attrName
 #define MAXSTRINGLEN 255                // max. length of string attribute
 
 
+// kinds of index an attribute may have
+enum IndexType {NOIDX = 0, BTREEIDX, HASHIDX, BITMAPIDX};
+
+
 // schema of relation catalog:
 //   relation name : char(32)           <-- lookup key
 //   attribute count : integer(4)
@@ -56,11 +63,25 @@ class RelCatalog : public HeapFile {
   // destroy a relation
   const Status destroyRel(const string & relation);
 
+  // build an index of the given type on an attribute of a relation;
+  // a hash index starts out with nBuckets buckets
+  const Status addIndex(const string & relation, const string & attrName,
+			const IndexType type, const int nBuckets);
+
+  // drop the index on an attribute, or all indexes of the relation
+  // if attrName is empty
+  const Status dropIndex(const string & relation, const string & attrName);
+
   // print catalog information
   const Status help(const string & relation);          // relation may be NULL
 
   // get rid of catalog
   ~RelCatalog();
+
+ private:
+  // copy of the catalog tuples, keyed by relation name; read in by
+  // the constructor and kept up to date by addInfo and removeInfo
+  unordered_map<string, RelDesc> relMap;
 };
 
 
@@ -70,6 +91,7 @@ class RelCatalog : public HeapFile {
 //   attribute number : integer(4)
 //   attribute type : integer(4)  (type is Datatype actually)
 //   attribute size : integer(4)
+//   indexed : integer(4)  (type is IndexType actually)
 
 
 typedef struct {
@@ -78,8 +100,13 @@ typedef struct {
   int attrOffset;                       // attribute offset
   int attrType;                         // attribute type
   int attrLen;                          // attribute length
+  int indexed;                          // type of index on it, NOIDX if none
 } AttrDesc;
 
+// attrcat tuples written before the indexed column was added end
+// where it starts; they are read as having no index
+const int OLDATTRDESCLEN = offsetof(AttrDesc, indexed);
+
 
 class AttrCatalog : public HeapFile {
  friend class RelCatalog;
@@ -107,15 +134,81 @@ class AttrCatalog : public HeapFile {
   // delete all information about a relation
   const Status dropRelation(const string & relation);
 
+  // record the type of index on an attribute
+  const Status setIndexed(const string & relation,
+			  const string & attrName,
+			  const int indexed);
+
   // close attribute catalog
   ~AttrCatalog();
+
+ private:
+  // copy of the catalog tuples of each relation, in catalog order,
+  // and of each tuple keyed by relation and attribute name; read in
+  // by the constructor and kept up to date by addInfo and removeInfo
+  unordered_map<string, vector<AttrDesc> > relAttrs;
+  unordered_map<string, AttrDesc> attrMap;
+};
+
+
+// schema of statistics catalog, filled in by analyze:
+//   relation name : char(32)           <-- lookup keys
+//   attribute name : char(32)          <--
+//   followed by the statistics of the attribute
+// values are stored in binary, strings cut to their first
+// STATVALSIZE bytes
+
+
+const int STATVALSIZE = 8;              // bytes of a value kept
+const int HISTBUCKETS = 10;             // max. buckets of a histogram
+
+
+typedef struct {
+  char relName[MAXNAME];                // relation name
+  char attrName[MAXNAME];               // attribute name
+  int attrType;                         // attribute type
+  int tupleCnt;                         // tuples in relation
+  int distinctCnt;                      // estimated distinct values
+  int defaultCnt;                       // tuples with 0 or ""
+  char minVal[STATVALSIZE];             // smallest value
+  char maxVal[STATVALSIZE];             // largest value
+  int bucketCnt;                        // buckets in histogram
+  char bucketHi[HISTBUCKETS][STATVALSIZE]; // upper bound of each of
+                                        // bucketCnt equi-depth buckets
+} StatDesc;
+
+
+class StatCatalog : public HeapFile {
+ public:
+  // open statistics catalog
+  StatCatalog(Status &status);
+
+  // get statistics of an attribute
+  const Status getInfo(const string & relation, 
+		       const string & attrName, 
+		       StatDesc &record);
+
+  // add information to catalog
+  const Status addInfo(StatDesc & record);
+
+  // remove the statistics of all attributes of a relation
+  const Status removeInfo(const string & relation);
+
+  // close statistics catalog
+  ~StatCatalog();
+
+ private:
+  // copy of the catalog tuples keyed by relation and attribute name
+  unordered_map<string, StatDesc> statMap;
 };
 
 
 extern RelCatalog  *relCat;
 extern AttrCatalog *attrCat;
+extern StatCatalog *statCat;
 extern Error error;
 extern Status createHeapFile(const string filename);
+extern Status createTempHeapFile(const string filename);
 extern Status destroyHeapFile(const string filename);
 
 #endif
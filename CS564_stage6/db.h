@@ -5,6 +5,7 @@
 #include <functional>
 #include "error.h"
 #include <string.h>
+#include <mutex>
 using namespace std;
 
 // define if debug output wanted
@@ -14,6 +15,7 @@ using namespace std;
 
 // forward class definition for db
 class DB;
+class TempFile;
 
 // class definition for open files
 class File {
@@ -29,6 +31,7 @@ class File {
   const Status writePage(const int pageNo,
 		   const Page* pagePtr);      // write page to file
   const Status getFirstPage(int& pageNo) const;     // returns pageNo of first page
+  bool isTemp() const { return tempFile != NULL; }  // a temporary file?
 
   bool operator == (const File & other) const
     {
@@ -58,6 +61,7 @@ class File {
   string fileName;                    // The name of the file
   int openCnt;                        // # times file has been opened
   int unixFile;                       // unix file stream for file
+  TempFile* tempFile;                 // its pages, if a temporary file
 };
 
 class BufMgr;
@@ -104,6 +108,7 @@ class DB {
   ~DB();                                // clean up any remaining open files
 
   const Status createFile(const string & fileName) ;  // create a new file
+  const Status createTempFile(const string & fileName); // ... kept in memory
   const Status destroyFile(const string & fileName) ; // destroy a file, 
                                                            // release all space
   const Status openFile(const string & fileName, File* & file);  // open a file
@@ -111,6 +116,8 @@ class DB {
 
  private:
   OpenFileHashTbl   openFiles;    // list of open files
+  mutex             dbLock;       // held while openFiles is in use, so
+                                  // files can be opened from several threads
 };
 
 
@@ -23,17 +23,86 @@ const unsigned MAXNAMESIZE = 50;
 
 enum Datatype { STRING, INTEGER, FLOAT };    // attribute data types
 enum Operator { LT, LTE, EQ, GTE, GT, NE };  // scan operators
+enum Connective { AND, OR };                 // combines scan predicates
+
+const int MAXPREDS = 10;        // max. number of terms in a scan predicate
+const unsigned int SAMPLESEED = 1;  // seed of the page samples taken by
+                                    // queries, so reruns agree
+
+// one term "attribute op filter" of a multi-predicate scan
+struct ScanPred
+{
+  int		offset;		// byte offset of attribute
+  int		length;		// length of attribute
+  Datatype	type;		// datatype of attribute
+  const char*	filter;		// comparison value
+  Operator	op;		// comparison operator
+};
+
+// a scan predicate compiled by startScan for one (Datatype, Operator)
+// pair: returns true if the attribute at attr satisfies the filter
+typedef bool (*PredFcn)(const char* attr, const char* filter,
+			const int length);
+
+// the predicate compiled for a (Datatype, Operator) pair
+const PredFcn getPredFcn(const Datatype type, const Operator op);
+
+// compare two values of a type the way the predicates do, strings
+// over at most length bytes: <0, 0 or >0 as a is below, equal to or
+// above b
+const int attrCmp(const char* a, const char* b, const Datatype type,
+		  const int length);
+
+// the same predicate applied to n attribute values at once,
+// storing the outcome for attrs[i] in keep[i]
+typedef void (*BatchPredFcn)(const char* const attrs[], const int n,
+			     const char* filter, const int length,
+			     bool keep[]);
+
+// The data pages of a heap file are listed, in file order, in a
+// page directory so that the k-th page can be found without reading
+// the k-1 pages before it.  The first HDRDIRSIZE entries live on the
+// header page, the rest on a chain of directory pages.  Files made
+// before there was a directory lack the DIRMAGIC marker; theirs is
+// built from the chain of data pages when they are opened.
+
+const int HDRDIRSIZE = (PAGESIZE - MAXNAMESIZE) / sizeof(int) - 8;
+const int DIRPAGESIZE = PAGESIZE / sizeof(int) - 1;
+const int DIRMAGIC = 0x44495231;	// "DIR1"
 
 struct FileHdrPage
 {
   char		fileName[MAXNAMESIZE];   // name of file
   int		firstPage;	// pageNo of first data page in file
   int		lastPage;	// pageNo of last data page in file
-  int		pageCnt;	// number of pages
+  int		pageCnt;	// number of pages (entries in the directory)
   int		recCnt;		// record count
+  int		firstDirPage;	// pageNo of first directory page, -1 if none
+  int		lastDirPage;	// pageNo of last directory page, -1 if none
+  int		dirMagic;	// DIRMAGIC if the directory is set up
+  int		dirPages[HDRDIRSIZE];	// first entries of the directory
+};
+
+struct DirPage
+{
+  int		nextDirPage;	// pageNo of next directory page, -1 if none
+  int		dirPages[DIRPAGESIZE];	// further entries of the directory
 };
 
 
+// a page worth of qualifying records returned by scanNextBatch().
+// the record pointers point into the pinned page and stay valid
+// until the next call to scanNextBatch() or endScan()
+struct ScanBatch
+{
+  int		cnt;		// number of records in the batch
+  RID		rid[MAXSLOTS];	// RIDs of the records
+  Record	rec[MAXSLOTS];	// pointer and length of each record
+};
+
+
+class ZoneMap;
+
 // class definition of heapFile
 class HeapFile {
 protected:
@@ -47,6 +116,25 @@ protected:
    bool  	curDirtyFlag;   // true if page has been updated
    RID   	curRec;         // rid of last record returned
 
+   // a copy of the entries of the directory page getDirEntry() read
+   // last, so that a scan looks its pages up one after the other
+   // without walking the chain of directory pages from the start
+   int		dirCacheFirst;	// index of its first entry, -1 if none
+   int		dirCacheCnt;	// number of entries copied
+   int		dirCachePageNo;	// pageNo of the directory page
+   int		dirCacheNext;	// pageNo of the one after it, -1 if none
+   int		dirCache[DIRPAGESIZE];
+
+   // add data page pageNo to the end of the page directory
+   const Status appendDirEntry(const int pageNo);
+
+   // build the page directory of a file made without one
+   const Status buildDir();
+
+   // shorten the page directory to cnt entries, disposing of the
+   // directory pages no longer needed
+   const Status truncateDir(const int cnt, int & pagesFreed);
+
 public:
 
   // initialize
@@ -58,8 +146,18 @@ public:
   // return number of records in file
   const int getRecCnt() const;
 
+  // return number of data pages in file
+  const int getPageCnt() const;
+
+  // look up the pageNo of the idx-th data page in the page directory
+  const Status getDirEntry(const int idx, int& pageNo);
+
   // given a RID, read record from file, returning pointer and length
   const Status getRecord(const RID &rid, Record & rec);
+
+  // pack the records into as few pages as possible and dispose of
+  // the pages left empty. invalidates all RIDs of the file
+  const Status vacuum(int & pagesFreed);
 };
 
 
@@ -78,6 +176,26 @@ public:
                            const char* filter, 
                            const Operator op);
 
+    // start a scan whose predicate is the AND (or the OR) of the
+    // predCnt terms in preds. The terms are evaluated most decisive
+    // first and evaluation stops as soon as the outcome is known
+    const Status startScan(const int predCnt,
+                           const ScanPred preds[],
+                           const Connective conn);
+
+    // restrict the scan to the data pages first..end-1 of the page
+    // directory, so that several scans can split up a file. must be
+    // called before the first record is fetched
+    const Status setPageRange(const int first, const int end);
+
+    // visit only a random sample of about pct percent of the data
+    // pages; the same seed picks the same pages. must be called
+    // before the first record is fetched
+    const Status setSample(const int pct, const unsigned int seed);
+
+    // true if the idx-th data page of the file is in the sample
+    const bool inSample(const int idx) const;
+
     const Status endScan(); // terminate the scan
     const Status markScan(); // save current position of scan
     const Status resetScan(); // reset scan to last marked location
@@ -85,9 +203,17 @@ public:
     // return RID of next record that satisfies the scan 
     const Status scanNext(RID& outRid);
 
+    // return all remaining records of the next page that has
+    // records satisfying the scan
+    const Status scanNextBatch(ScanBatch& batch);
+
     // read current record, returning pointer and length
     const Status getRecord(Record & rec);
 
+    // make rid the current record and read it, setting match to
+    // whether it satisfies the predicate of the scan
+    const Status fetchRecord(const RID & rid, Record & rec, bool & match);
+
     // delete current record 
     const Status deleteRecord();
 
@@ -95,11 +221,12 @@ public:
     const Status markDirty();
 
 private:
-    int   offset;            // byte offset of filter attribute
-    int   length;            // length of filter attribute
-    Datatype type;           // datatype of filter attribute
-    const char* filter;      // comparison value of filter
-    Operator op;             // comparison operator of filter
+    int   predCnt;           // number of terms, 0 if no filtering
+    ScanPred preds[MAXPREDS];        // terms in evaluation order
+    PredFcn pred[MAXPREDS];          // compiled terms, set by startScan
+    BatchPredFcn batchPred[MAXPREDS];// compiled terms for a page of records
+    Connective conn;         // how the terms are combined
+    ZoneMap* zoneMap;        // page summaries, NULL if the file has none
 
      // The following variables are used to preserve the state
     // of the scan when the method markScan() is invoked.
@@ -107,8 +234,19 @@ private:
     // scan to be rolled back to the following
     int   markedPageNo;	// page number of pinned page
     RID   markedRec;         // rid of last record returned
+    int   markedIdx;         // directory index of pinned page
+
+    int   firstIdx;          // start of page range
+    int   curIdx;            // directory index of the current page
+    int   endIdx;            // end of page range, -1 to follow the
+                             // page chain to the end of the file
+    int   samplePct;         // percentage of pages sampled, 100 if all
+    unsigned int sampleSeed; // picks the pages of the sample
+
+    const Status nextScanPage(int& pageNo);
 
     const bool matchRec(const Record & rec) const;
+    const int filterBatch(ScanBatch & batch, const int n) const;
 };
 
 
@@ -123,6 +261,17 @@ public:
 
     // insert record into file, returning its RID
     const Status insertRecord(const Record & rec, RID& outRid); 
+
+    // insert cnt records into file, returning their RIDs in outRids
+    // unless it is NULL
+    const Status insertRecords(const int cnt, const Record recs[],
+                               RID outRids[]);
+
+private:
+    ZoneMap* zoneMap;        // page summaries, NULL if the file has none
+
+    // start a new last page and make it the current page
+    const Status addPage();
 };
 
 #endif
@@ -0,0 +1,55 @@
+#ifndef INDEX_H
+#define INDEX_H
+
+#include "catalog.h"
+#include "btree.h"
+#include "linhash.h"
+#include "bitmap.h"
+
+// most (key, RID) pairs sorted in memory at once when a B+-tree is
+// built
+const int INDEXSORTITEMS = 20000;
+
+// The indexes of one relation, opened together so that a tuple can
+// be added to or taken out of all of them at once.  The attributes
+// that have an index are marked in the attribute catalog with the
+// type of their index, a B+-tree, a linear hash index or a bitmap
+// index.
+
+class IndexSet
+{
+public:
+
+  // open every index of a relation
+  IndexSet(const string & relation, Status & status);
+
+  // close the indexes
+  ~IndexSet();
+
+  // true if the relation has no index
+  const bool empty() const { return trees.empty(); }
+
+  // add the entries of tuple rec, stored at rid, to every index
+  const Status insertEntries(const Record & rec, const RID & rid);
+
+  // take the entries of tuple rec, stored at rid, out of every index
+  const Status deleteEntries(const Record & rec, const RID & rid);
+
+  // build the index on attribute attr of a relation from its tuples;
+  // attr.indexed gives its type, nBuckets the buckets of a hash index
+  static const Status build(const AttrDesc & attr, const int nBuckets);
+
+  // remove the index file of attribute attr
+  static const Status drop(const AttrDesc & attr);
+
+  // build the indexes of a relation anew, after its tuples moved
+  static const Status rebuild(const string & relation);
+
+private:
+  vector<AttrDesc>	attrs;		// the indexed attributes
+  vector<BTreeIndex*>	trees;		// the B+-tree on each of them,
+  vector<LinHashIndex*>	hashes;		// or the hash index,
+  vector<BitmapIndex*>	bitmaps;	// or the bitmap index
+};
+
+#endif
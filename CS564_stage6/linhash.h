@@ -0,0 +1,119 @@
+#ifndef LINHASH_H
+#define LINHASH_H
+
+#include "heapfile.h"
+
+// A linear hashing index on one attribute of a relation, kept in a
+// file of its own.  It starts out with the number of buckets given
+// when it is built, and grows a bucket at a time: whenever the
+// entries outgrow the buckets, the bucket at the split pointer is
+// split in two and the pointer moves on, so that no insert ever has
+// to rehash the whole index.  A bucket is a primary page and a chain
+// of overflow pages, and its primary page is found through the
+// directory, so a lookup reads a directory page and the bucket.
+//
+// Deletions only take entries out of their pages: buckets are never
+// merged, and emptied overflow pages stay in their chains.
+
+// average fill of the buckets above which the next bucket is split
+const float LINHASHLOAD = 0.75;
+
+// first page of an index file
+struct LinHashHdr
+{
+  int		keyType;	// Datatype of the key
+  int		keyLen;		// length of the key in bytes
+  int		initBuckets;	// number of buckets it was built with
+  int		level;		// the buckets were doubled this many times
+  int		next;		// the next bucket to split
+  int		bucketCnt;	// number of buckets
+  int		entryCnt;	// number of entries
+  int		dirCnt;		// number of directory pages
+  int		dirPages[(PAGESIZE - 8 * sizeof(int)) / sizeof(int)];
+};
+
+// a directory page: the pageNo of the primary page of each bucket
+const int LINHASHDIRCAP = PAGESIZE / sizeof(int);
+
+// a page of a bucket, holding keyCnt (key, RID) entries
+struct LinHashPage
+{
+  int		keyCnt;		// number of entries in the page
+  int		nextPage;	// pageNo of the overflow page, -1 if none
+  char		data[PAGESIZE - 2 * sizeof(int)];
+};
+
+class LinHashIndex
+{
+public:
+
+  // create the index on attribute attrName of relName with nBuckets
+  // (empty) buckets
+  static const Status create(const string & relName,
+			     const string & attrName,
+			     const Datatype type, const int keyLen,
+			     const int nBuckets);
+
+  // remove the index on attribute attrName of relName
+  static const Status destroy(const string & relName,
+			      const string & attrName);
+
+  // open the index on attribute attrName of relName
+  LinHashIndex(const string & relName, const string & attrName,
+	       Status & status);
+
+  // end any scan and close the index
+  ~LinHashIndex();
+
+  // add the entry (key, rid); key points at keyLen bytes
+  const Status insertEntry(const void* key, const RID & rid);
+
+  // remove the entry (key, rid), RECNOTFOUND if there is none
+  const Status deleteEntry(const void* key, const RID & rid);
+
+  // start a scan of the entries whose key equals value
+  const Status startScan(const void* value);
+
+  // return the RID of the next entry of the scan, NOMORERECS at end
+  const Status scanNext(RID & outRid);
+
+  // the same, also pointing key at the key of the entry, which stays
+  // valid until the next call
+  const Status scanNext(RID & outRid, const char* & key);
+
+  // end the scan
+  const Status endScan();
+
+  // number of entries in the index
+  const int getEntryCnt() const { return hdr->entryCnt; }
+
+  // number of buckets in the index
+  const int getBucketCnt() const { return hdr->bucketCnt; }
+
+private:
+  File*		file;		// the index file
+  int		hdrPageNo;	// pageNo of the header page, kept pinned
+  LinHashHdr*	hdr;		// the header page
+  bool		hdrDirty;	// true if the header page was updated
+  Datatype	type;		// datatype of the key
+  int		keyLen;		// length of the key
+  int		pageCap;	// max. entries in a page
+
+  // state of the scan
+  int		scanPageNo;	// pinned page of the bucket, -1 if none
+  LinHashPage*	scanPage;
+  int		scanPos;	// next entry of the page
+  vector<char>	scanKey;
+
+  const unsigned int hashKey(const char* key) const;
+  const bool keyEq(const char* a, const char* b) const;
+  const int entrySize() const { return keyLen + sizeof(RID); }
+  char* entry(LinHashPage* page, const int i) const;
+  const int bucketOf(const char* key) const;
+  const Status bucketPage(const int bucket, int & pageNo);
+  const Status addBucket(int & pageNo);
+  const Status addToChain(const int pageNo, const char* entry);
+  const Status split();
+};
+
+#endif
@@ -26,13 +26,17 @@ const unsigned PAGESIZE = 1024;
 const unsigned DPFIXED= sizeof(slot_t)+4*sizeof(short)+2*sizeof(int);
 const unsigned PAGEDATASIZE = PAGESIZE-DPFIXED+sizeof(slot_t);
 // size of the data area of a page
+const int MAXSLOTS = (PAGESIZE-DPFIXED)/sizeof(slot_t) + 1;
+// upper bound on the number of records on a page
 
 // Class definition for a minirel data page.   
-// The design assumes that records are kept compacted when
-// deletions are performed. Notice, however, that the slot
-// array cannot be compacted.  Notice, this class does not keep
-// the records align, relying instead on upper levels to take
-// care of non-aligned attributes
+// Deletions only free the slot; the hole left in data[] is
+// reclaimed lazily by compact(), which insertRecord() calls when
+// the contiguous free space is too small, and which the heap file
+// layer calls once before it unpins a page it has deleted from.
+// Notice, however, that the slot array cannot be compacted.
+// Notice, this class does not keep the records align, relying
+// instead on upper levels to take care of non-aligned attributes
 
 class Page {
 private:
@@ -45,6 +49,9 @@ private:
     int		nextPage; // forwards pointer
     int		curPage;  // page number of current pointer
 
+    // number of free bytes between freePtr and the slot array
+    const short getContigSpace() const;
+
 public:
     void init(const int pageNo); // initialize a new page
     void dumpPage() const;       // dump contents of a page
@@ -53,9 +60,19 @@ public:
     const Status setNextPage(const int pageNo); // sets value of nextPage to pageNo
     const short getFreeSpace() const; // returns amount of free space
 
+    // returns number of free bytes lost in holes left by deletions
+    const short getFragSpace() const;
+
+    // slide records together so that all free space is contiguous
+    void compact();
+
     // inserts a new record (rec) into the page, returns RID of record 
     const Status insertRecord(const Record & rec, RID& rid);
 
+    // adds a new record (rec) after the last slot without looking for
+    // an empty slot to reuse, returns RID of record
+    const Status appendRecord(const Record & rec, RID& rid);
+
     // delete the record with the specified rid
     const Status deleteRecord(const RID & rid);
 
@@ -53,12 +53,16 @@ typedef enum {
     N_DESTROY,
     N_BUILD,
     N_REBUILD,
+    N_BITMAP,
     N_DROP,
     N_LOAD,
     N_PRINT,
     N_HELP,
+    N_VACUUM,
+    N_ANALYZE,
     N_SELECT,
     N_JOIN,
+    N_PREDLIST,
     N_PRIMATTR,
     N_QUALATTR,
     N_ATTRVAL,
@@ -82,6 +86,7 @@ typedef struct node {
 	    char *relname;
 	    struct node *attrlist;
 	    struct node *qual;
+	    int samplepct;
 	} QUERY;
 
 	// insert node */
@@ -137,6 +142,17 @@ typedef struct node {
 	    char *relname;
 	} HELP;
 
+	// vacuum node */
+	struct {
+	    char *relname;
+	} VACUUM;
+
+	// analyze node */
+	struct {
+	    char *relname;
+	    int samplepct;
+	} ANALYZE;
+
 	// select node */
 	struct {
 	    struct node *selattr;
@@ -151,6 +167,12 @@ typedef struct node {
 	    struct node *joinattr2;
 	} JOIN;
 
+	// and/or of select nodes */
+	struct {
+	    int conn;
+	    struct node *preds;
+	} PREDLIST;
+
 	// qualified attribute node */
 	struct {
 	    char *relname;
@@ -212,19 +234,23 @@ typedef struct node {
 //
 
 NODE *newnode(int kind);
-NODE *query_node(char *relname, NODE *attrlist, NODE *n);
+NODE *query_node(char *relname, NODE *attrlist, NODE *n, int samplepct);
 NODE *insert_node(char *relname, NODE *attrlist);
 NODE *delete_node(char *relname, NODE *qual);
 NODE *create_node(char *relname, NODE *attrlist, NODE *primattr);
 NODE *destroy_node(char *relname);
 NODE *build_node(char *relname, char *attrname, int nbuckets);
 NODE *rebuild_node(char *relname, char *attrname, int nbuckets);
+NODE *bitmap_node(char *relname, char *attrname);
 NODE *drop_node(char *relname, char *attrname);
 NODE *load_node(char *relname, char *filename);
 NODE *print_node(char *relname);
 NODE *help_node(char *relname);
+NODE *vacuum_node(char *relname);
+NODE *analyze_node(char *relname, int samplepct);
 NODE *select_node(NODE *selattr, int op, NODE *value);
 NODE *join_node(NODE *joinattr1, int op, NODE *joinattr2);
+NODE *predlist_node(int conn, NODE *preds);
 NODE *qualattr_node(char *relname, char *attrname);
 NODE *primattr_node(char *attrname, int nbuckets);
 NODE *attrval_node(char *attrname, NODE *value);
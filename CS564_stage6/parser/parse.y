@@ -72,7 +72,13 @@ static NODE *parse_tree;                // root of parse tree
 		T_QSTRING
 		T_SHELL_CMD
 
+%token		RW_VACUUM
+		RW_ANALYZE
+		RW_SAMPLE
+		RW_BITMAP
+
 %type	<ival>	op
+		opt_sample
 
 %type	<sval>	opt_into_relname
 		opt_relname
@@ -85,19 +91,22 @@ static NODE *parse_tree;                // root of parse tree
 		create
 		destroy
 		build
-/*
 		rebuild
-*/
+		bitmap
 		drop
 		load
 		print
 		help
+		vacuum
+		analyze
 		quit
 		opt_primary_attr
 		opt_where
 		qual
 		selection
 		join
+		conj_list
+		disj_list
 		non_mt_qualattr_list
 		qualattr
 /*
@@ -148,13 +157,14 @@ command
 	| create
 	| destroy
 	| build
-/*
 	| rebuild
-*/
+	| bitmap
 	| drop
 	| load
 	| print
 	| help
+	| vacuum
+	| analyze
 	| quit
 	| nothing
 	{
@@ -163,7 +173,7 @@ command
 	;
 
 query
-	: RW_SELECT non_mt_qualattr_list opt_into_relname RW_FROM table_list opt_where
+	: RW_SELECT non_mt_qualattr_list opt_into_relname RW_FROM table_list opt_sample opt_where
 /*	RW_SELECT opt_into_relname '(' non_mt_qualattr_list ')' opt_where */
 	{
 		NODE *where;
@@ -172,12 +182,12 @@ query
 		  $$ = NULL;
 		}
 		else {
-		  where = replace_alias_in_condition($5, $6);
-		  if ((where == NULL) && ($6 != NULL)) {
+		  where = replace_alias_in_condition($5, $7);
+		  if ((where == NULL) && ($7 != NULL)) {
 		     $$ = NULL; //something wrong in where condition
 		  }
 		  else {
-		    $$ = query_node($3, qualattr_list, where);
+		    $$ = query_node($3, qualattr_list, where, $6);
 		  }
 		}
 	}
@@ -276,14 +286,19 @@ build
 	}
 	;
 
-/*
 rebuild
 	: RW_REBUILD string '(' string ')' RW_NUMBUCKETS T_EQ T_INT
 	{
 		$$ = rebuild_node($2, $4, $8);
 	}
 	;
-*/
+
+bitmap
+	: RW_BITMAP string '(' string ')'
+	{
+		$$ = bitmap_node($2, $4);
+	}
+	;
 
 drop
 	: RW_DROP string '(' string ')'
@@ -316,6 +331,20 @@ help
 	}
 	;
 
+vacuum
+	: RW_VACUUM string
+	{
+		$$ = vacuum_node($2);
+	}
+	;
+
+analyze
+	: RW_ANALYZE string opt_sample
+	{
+		$$ = analyze_node($2, $3);
+	}
+	;
+
 quit
 	: RW_QUIT ';'
 	{
@@ -356,6 +385,17 @@ opt_relname
 	}
 	;
 	
+opt_sample
+	: RW_SAMPLE T_INT
+	{
+		$$ = $2;
+	}
+	| nothing
+	{
+		$$ = 100;
+	}
+	;
+
 opt_where
 	: RW_WHERE qual
 	{
@@ -370,6 +410,36 @@ opt_where
 qual
 	: selection
 	| join
+	| selection RW_AND conj_list
+	{
+		$$ = predlist_node(AND, prepend($1, $3));
+	}
+	| selection RW_OR disj_list
+	{
+		$$ = predlist_node(OR, prepend($1, $3));
+	}
+	;
+
+conj_list
+	: selection RW_AND conj_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| selection
+	{
+		$$ = list_node($1);
+	}
+	;
+
+disj_list
+	: selection RW_OR disj_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| selection
+	{
+		$$ = list_node($1);
+	}
 	;
 
 selection
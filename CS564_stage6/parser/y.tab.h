@@ -78,7 +78,11 @@
      T_REAL = 294,
      T_STRING = 295,
      T_QSTRING = 296,
-     T_SHELL_CMD = 297
+     T_SHELL_CMD = 297,
+     RW_VACUUM = 298,
+     RW_ANALYZE = 299,
+     RW_SAMPLE = 300,
+     RW_BITMAP = 301
    };
 #endif
 /* Tokens.  */
@@ -122,6 +126,10 @@
 #define T_STRING 295
 #define T_QSTRING 296
 #define T_SHELL_CMD 297
+#define RW_VACUUM 298
+#define RW_ANALYZE 299
+#define RW_SAMPLE 300
+#define RW_BITMAP 301
 
 
 
@@ -7,6 +7,16 @@
 // define if debug output wanted
 //#define DEBUGPART
 
+// Buffer frames partitioning leaves to its caller and to the file it
+// reads when it works out how many partitions it can write at once.
+// Each partition being written pins two frames: the header page and
+// the current page.
+const int PARTRESERVE = 4;
+
+// A partition that is still too large after this many levels of
+// re-partitioning is left as it is.
+const int MAXPARTDEPTH = 4;
+
 
 class Partition {
  public:
@@ -14,15 +24,59 @@ class Partition {
 	    const string & fileName,             // (base) name of heap file
 	    const int P,                      // number of partitions
 	    const int (*hashfcn)(const Record & rec,
-				 const int P),  
+				 const int P,
+				 const int seed),
 	                               // hash function to use in partitioning
+	    const int maxPages,         // pages a partition may have
 	    string* &partName,           // names of partitioned heap files
+	    int &partCnt,                // number of partitions
 	    Status &status);            // create partitions of file
+
+  // partition rel exactly as like was partitioned, re-partitioning
+  // the same partitions, so that the records of rel go to the
+  // partition of like with the same number as the records they
+  // hash alike with
+  Partition(HeapFileScan *rel,
+	    const string & fileName,
+	    const Partition & like,
+	    string* &partName,
+	    int &partCnt,
+	    Status &status);
+
   ~Partition();                         // destroy partitions
 
+  const int getPageCnt(const int p) const; // pages of partition p
+
+  // true if partition p is larger than maxPages but could not be
+  // split, because its records hash alike with every seed
+  const bool isSkewed(const int p) const;
+
  private:
 
+  // The partitions form a tree. The root is the file partitioned,
+  // and a partition that comes out with more than maxPages pages is
+  // split again, with the next hash seed, into partitions of its
+  // own. The partitions that are not split are the leaves, and the
+  // ones handed to the caller, in depth first order.
+
+  typedef struct {
+    string name;                        // name of the partition file
+    int fanOut;                         // number of children, 0 if none
+    int child;                          // index of its first child
+    int pages;                          // pages of the partition
+    bool created;                       // true if the file still exists
+    bool skewed;                        // too large, but not split
+  } PNODE;
+
+  const Status split(HeapFileScan *rel, const int n, const int depth,
+		     const Partition *like);
+  const Status finish(string* &partName, int &partCnt, Status status);
+
   int P;                                // number of partitions
+  const int (*hashfcn)(const Record & rec, const int P, const int seed);
+  int maxPages;                         // pages a partition may have
+  vector<PNODE> nodes;                  // the tree, nodes[0] is the root
+  vector<int> leaves;                   // node of each partition
   string *partName;                      // partition names
 };
 
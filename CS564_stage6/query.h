@@ -17,6 +17,15 @@ const Status QU_Select(const string & result,
 		       const Operator op, 
 		       const char *attrValue);
 
+const Status QU_Select(const string & result, 
+		       const int projCnt, 
+		       const attrInfo projNames[],
+		       const int predCnt,
+		       const attrInfo predAttrs[],
+		       const Operator ops[],
+		       const Connective conn,
+		       const int samplePct);
+
 const Status QU_Join(const string & result, 
 		     const int projCnt, 
 		     const attrInfo projNames[],
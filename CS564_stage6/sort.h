@@ -1,21 +1,31 @@
 #ifndef SORT_H
 #define SORT_H
 
+#include <atomic>
 #include "heapfile.h"
 
 // define if debug output wanted
 //#define DEBUGSORT
 
+// Buffer frames a sort leaves to its caller (and to the run it writes)
+// when it works out how many runs it can merge at once. Each run being
+// merged pins two frames: the header page and the current page.
+const int SORTRESERVE = 8;
 
-// SORTREC is an in-memory sort record that qsort(3) sorts.
-// The sort attribute as well as the associated RID are
-// stored in the record. The RID is used for fetching the
-// full record when it is needed.
+
+// SORTREC is an in-memory sort record kept in the heap of
+// replacement selection. It points at a copy of the whole record,
+// held in the record arena of the sort, so that the runs are
+// written without going back to the source file. The sort moves
+// SORTRECs only, never the records themselves.
 
 typedef struct {
-  RID rid;                              // record id of current record
+  char* data;                           // the record, in the arena
+  int recLen;                           // length of the record
   char* field;                          // pointer to field
   int length;                           // length of field
+  unsigned long long key;               // normalized key of field
+  int run;                              // sub-run the record goes to
 } SORTREC;
 
 
@@ -32,10 +42,6 @@ class SortedFile {
   ~SortedFile();                        // destroy temporary structures / files
 
  private:
-  Status sortFile();                    // split source file into sub-runs
-  Status generateRun(int numItems);     // generate one sub-run of file
-  Status startScans();                  // start a scan on each sorted run
-
   typedef struct {
     string name;                        // name of run file
     HeapFileScan* inFile;               // ptr to input file
@@ -46,18 +52,69 @@ class SortedFile {
     RID mark;
   } RUN;
 
+  // records staged for a sub-run, appended to it a page at a time
+  typedef struct {
+    char chunk[PAGESIZE];
+    Record recs[MAXSLOTS];
+    int cnt, used;
+  } STAGE;
+
+  // A run generator turns a range of the pages of the source file
+  // into sub-runs, with a share of the sort buffer of its own. A
+  // large source file is split among several generators, each
+  // running in a thread of its own; a small one has just one.
+
+  typedef struct {
+    int first, end;                     // directory indices of its pages
+    HeapFileScan* hfs;                  // scan of those pages
+    ScanBatch batch;                    // page of source records
+    int nextInBatch;                    // next record of batch
+
+    SORTREC* buffer;                    // in-memory sort buffer
+    char* arena;                        // the records of buffer[]
+    int slotLen;                        // bytes of a record in arena
+    int maxItems;                       // max. # of items in buffer
+
+    STAGE stage;                        // records staged for its run
+    vector<RUN> runs;                   // the sub-runs it wrote
+    Status status;
+  } RUNGEN;
+
+  Status sortFile();                    // split source file into sub-runs
+  void runGenerator(RUNGEN* gen);       // body of a generator thread
+  Status generateRuns(RUNGEN & gen);    // sort gen's pages into sub-runs
+  Status nextItem(RUNGEN & gen, SORTREC & item); // read next source record
+  Status growArena(RUNGEN & gen, int len); // make arena slots len bytes
+  Status startRun(RUN & run, STAGE & stage); // create a new sub-run
+  Status addToRun(RUN & run, STAGE & stage, const Record & rec);
+  Status endRun(RUN & run, STAGE & stage); // write out the sub-run
+  Status mergeRuns(int n);              // merge the first n sub-runs
+  Status startScans();                  // start a scan on each sorted run
+  Status fetch(int i);                  // read next record of run i
+  bool runLess(int a, int b) const;     // run a's record sorts first?
+  void buildTree();                     // play the merge tournament
+  void replay(int i);                   // replay it from run i up
+
   vector<RUN> runs;                   // holds info about each sub-run
+  atomic<int> runCnt;                   // number of sub-runs written
+
+  // The runs are merged by a tournament (loser) tree: tree[n] holds
+  // the run that lost the match at inner node n, and winner the run
+  // with the smallest record overall. The runs are the leaves, leaf
+  // i being node runs.size() + i.
+
+  vector<int> tree;                     // loser of each match
+  int winner;                           // run with the smallest record
+  bool treeBuilt;                       // false until all runs are read
+
+  typedef int (*KEYCMP)(const char* p1, const char* p2, int length);
+  KEYCMP keycmp;                        // compares sort attributes
 
-  HeapFile* hfile;                   // source file to sort
-  HeapFileScan* hfs;                   // source file to sort
   string fileName;                      // name of source file to sort
   Datatype type;                        // type of sort attribute
   int offset;                           // offset of sort attribute
   int length;                           // length of sort attribute
-
-  SORTREC* buffer;                      // in-memory sort buffer
   int maxItems;                         // max. # of items/tuples in buffer
-  int numItems;                         // current # of items in buffer
 };
 
 #endif
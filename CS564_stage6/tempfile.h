@@ -0,0 +1,57 @@
+#ifndef TEMPFILE_H
+#define TEMPFILE_H
+
+#include <vector>
+#include <map>
+#include "db.h"
+
+class Page;
+
+// define if debug output wanted
+//#define DEBUGTEMP
+
+// Pages of temporary files kept in memory, all files together
+const int TEMPBUDGET = 4096;
+
+// A temporary file: a sort run, a partition or the like, which is
+// destroyed by the query that made it. Its pages are kept in memory
+// rather than in a Unix file, so making, reading and destroying it
+// costs no system calls. The pages of all temporary files share a
+// budget of TEMPBUDGET pages. A temporary file that needs a page
+// when the budget is used up spills: its pages are written to a
+// Unix file of the same name, and it is read and written there from
+// then on. The DB layer opens a temporary file like any other; File
+// sends its reads and writes here.
+
+class TempFile {
+ public:
+
+  // create an empty temporary file, holding just the DB header page
+  static const Status create(const string & fileName);
+
+  // destroy a temporary file, and its Unix file if it spilled
+  static const Status destroy(const string & fileName);
+
+  // the temporary file fileName, NULL if there is none
+  static TempFile* find(const string & fileName);
+
+  const Status read(const int pageNo, Page* pagePtr);
+  const Status write(const int pageNo, const Page* pagePtr);
+
+ private:
+
+  TempFile(const string & fname);
+  ~TempFile();
+
+  const Status spill();                 // move the pages to a Unix file
+
+  string fileName;                      // The name of the file
+  vector<Page*> pages;                  // its pages, until it spills
+  int unixFile;                         // Unix file once spilled, else -1
+
+  static map<string, TempFile*> files;  // all temporary files
+  static int memPages;                  // pages in memory, all files
+  static mutex tempLock;                // held while any of them is used
+};
+
+#endif
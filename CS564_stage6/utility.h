@@ -27,6 +27,10 @@ const Status UT_Load(const string & relation,
 
 const Status UT_Print(string relation);
 
+const Status UT_Vacuum(const string & relation);
+
+const Status UT_Analyze(const string & relation, const int samplePct);
+
 void   UT_Quit(void);
 
 #endif
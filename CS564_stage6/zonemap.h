@@ -0,0 +1,81 @@
+#ifndef ZONEMAP_H
+#define ZONEMAP_H
+
+#include "heapfile.h"
+
+// A zone map keeps, for every data page of a relation, the smallest
+// and largest value of each attribute stored on the page (the first
+// ZONEPREFIX bytes for strings).  A scan can then pass over the pages
+// whose values cannot satisfy its predicate without reading them.
+//
+// The zone map of relation R lives in the Unix file R.zmap next to the
+// heap file, with one entry per page directory index.  Summaries only
+// ever widen: inserts extend them, deletes leave them alone, so they
+// may be loose but never exclude a record that is on the page.
+
+const int ZONEPREFIX = 8;		// bytes of a string kept in a zone
+
+// layout of one attribute summarized by the zone map
+struct ZoneAttr
+{
+  int		offset;		// byte offset of attribute
+  int		length;		// length of attribute
+  Datatype	type;		// datatype of attribute
+};
+
+// range of values of one attribute on one page
+struct Zone
+{
+  char		lo[ZONEPREFIX];	// smallest value (or string prefix)
+  char		hi[ZONEPREFIX];	// largest value (or string prefix)
+};
+
+class ZoneMap
+{
+public:
+
+  // create the (empty) zone map of a new relation
+  static const Status create(const string & relName,
+			     const int attrCnt, const ZoneAttr attrs[]);
+
+  // remove the zone map of a relation, if it has one
+  static const Status destroy(const string & relName);
+
+  // read in the zone map of a relation
+  ZoneMap(const string & relName, Status & status);
+
+  // write the zone map back if it has been updated
+  ~ZoneMap();
+
+  // note that the idx-th data page is a new (or emptied) page
+  void newPage(const int idx);
+
+  // forget the pages from the cnt-th one on
+  void truncate(const int cnt);
+
+  // widen the zones of the idx-th data page to cover record rec
+  void add(const int idx, const Record & rec);
+
+  // false if no record on the idx-th data page can satisfy the AND
+  // (or the OR) of the predCnt terms in preds
+  const bool mayMatch(const int idx, const int predCnt,
+		      const ScanPred preds[], const Connective conn) const;
+
+  // write the zone map to disk
+  const Status flush();
+
+private:
+  // state of a page: no records yet, zones cover its records, or
+  // records were put on it while the zone map was not kept up
+  enum { EMPTY, SET, UNKNOWN };
+
+  string	fileName;	// name of the Unix file
+  bool		dirty;		// true if updated since read in
+  vector<ZoneAttr> attrs;	// attributes summarized
+  vector<char>	state;		// state of each page
+  vector<Zone>	zones;		// attrs.size() zones per page
+
+  const int findAttr(const ScanPred & term) const;
+};
+
+#endif